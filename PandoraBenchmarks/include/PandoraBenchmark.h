@@ -0,0 +1,219 @@
+/**
+ *  @file   PandoraBenchmarks/include/PandoraBenchmark.h
+ *
+ *  @brief  Header file for PandoraBenchmark, measuring the throughput and resource usage of pandora reconstruction chains.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_BENCHMARK_H
+#define PANDORA_BENCHMARK_H 1
+
+#include <atomic>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace pandora {class Pandora;}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace pandora_benchmark
+{
+
+typedef std::vector<const pandora::Pandora *> PandoraInstanceList;
+
+/**
+ *  @brief  Parameters class
+ */
+class Parameters
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    Parameters();
+
+    std::string     m_settingsFile;             ///< The path to the pandora settings xml file
+    std::string     m_detector;                 ///< The detector type (LAr or LC), determining the content library to register
+    std::string     m_csvFile;                  ///< The path to a csv file to which results are appended, if required
+    std::string     m_baselineFile;             ///< The path to a csv file of baseline results, against which to check for regressions
+    float           m_tolerance;                ///< The fractional tolerance on events per second and allocations per event, for the check
+    int             m_nEvents;                  ///< The number of events to measure
+    int             m_nWarmUpEvents;            ///< The number of events processed before measurement begins
+    int             m_nSyntheticHits;           ///< The number of synthetic hits per view in each event, zero if events are read via the settings
+    int             m_nWorkers;                 ///< The number of pandora instances, each processing events in its own thread
+    unsigned int    m_seed;                     ///< The seed for the synthetic event generator
+};
+
+/**
+ *  @brief  Results class
+ */
+class Results
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    Results();
+
+    int             m_nEvents;                  ///< The number of measured events
+    double          m_inputTime;                ///< The total time spent creating input objects, in seconds
+    double          m_processTime;              ///< The total time spent in PandoraApi::ProcessEvent, in seconds
+    double          m_resetTime;                ///< The total time spent in PandoraApi::Reset, in seconds
+    unsigned long   m_nAllocations;             ///< The total number of heap allocations
+    unsigned long   m_allocatedBytes;           ///< The total number of bytes allocated on the heap
+    long            m_peakRSS;                  ///< The peak resident set size, in kilobytes
+    double          m_eventsPerSecond;          ///< The number of measured events divided by the wall time taken to process them
+};
+
+/**
+ *  @brief  EventQueue class, handing out the event numbers to the workers in input order
+ */
+class EventQueue
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  nEvents the number of events in the queue
+     */
+    EventQueue(const int nEvents);
+
+    /**
+     *  @brief  Take the next event from the queue
+     *
+     *  @param  eventNumber to receive the event number
+     *
+     *  @return whether an event was available
+     */
+    bool GetNextEvent(int &eventNumber);
+
+    /**
+     *  @brief  Stop handing out events, e.g. when the input files are exhausted
+     */
+    void Stop();
+
+private:
+    const int           m_nEvents;              ///< The number of events in the queue
+    std::atomic<int>    m_nextEvent;            ///< The next event number to hand out
+    std::atomic<bool>   m_isStopped;            ///< Whether the queue has been stopped
+};
+
+/**
+ *  @brief  Create a pandora instance, registering the content, creating any synthetic geometry and reading the settings
+ *
+ *  @param  parameters the application parameters
+ *
+ *  @return address of the new pandora instance
+ */
+const pandora::Pandora *CreatePandoraInstance(const Parameters &parameters);
+
+/**
+ *  @brief  Register the algorithms and plugins of the content library for the chosen detector
+ *
+ *  @param  pandora the pandora instance
+ *  @param  parameters the application parameters
+ */
+void RegisterContent(const pandora::Pandora &pandora, const Parameters &parameters);
+
+/**
+ *  @brief  Create the single tpc geometry used by the synthetic lar events
+ *
+ *  @param  pandora the pandora instance
+ */
+void CreateSyntheticLArGeometry(const pandora::Pandora &pandora);
+
+/**
+ *  @brief  Create the calo hits for a synthetic lar event, containing projections of track-like and shower-like 3D particles
+ *
+ *  @param  pandora the pandora instance
+ *  @param  parameters the application parameters
+ *  @param  generator the random number generator
+ *  @param  hitCounter the running hit counter, used to provide unique parent addresses
+ */
+void CreateSyntheticLArEvent(const pandora::Pandora &pandora, const Parameters &parameters, std::mt19937 &generator, int &hitCounter);
+
+/**
+ *  @brief  Process the warm-up events, then the measured events from a shared queue, with one worker thread per pandora instance
+ *
+ *  @param  pandoraInstances the pandora instances
+ *  @param  parameters the application parameters
+ *  @param  results to receive the combined results
+ */
+void RunWorkers(const PandoraInstanceList &pandoraInstances, const Parameters &parameters, Results &results);
+
+/**
+ *  @brief  Run a function concurrently in a number of worker threads, rethrowing the first exception raised by any worker
+ *
+ *  @param  nWorkers the number of worker threads
+ *  @param  work the function to run, receiving the index of its worker
+ */
+void RunInWorkerThreads(const unsigned int nWorkers, const std::function<void(const unsigned int)> &work);
+
+/**
+ *  @brief  Create the input for an event, process it, then reset the pandora instance
+ *
+ *  @param  pandora the pandora instance
+ *  @param  parameters the application parameters
+ *  @param  eventNumber the event number, which seeds the synthetic event generator
+ *  @param  results to receive the timing and allocation results for the event
+ *
+ *  @return whether an event was processed, false if the input files are exhausted
+ */
+bool ProcessEvent(const pandora::Pandora &pandora, const Parameters &parameters, const int eventNumber, Results &results);
+
+/**
+ *  @brief  Print the results to the screen and, if requested, append them to the csv file
+ *
+ *  @param  parameters the application parameters
+ *  @param  results the results
+ */
+void WriteResults(const Parameters &parameters, const Results &results);
+
+/**
+ *  @brief  Compare the results with the last baseline entry for the same settings file name, detector, synthetic hits and workers
+ *
+ *  @param  parameters the application parameters
+ *  @param  results the results
+ *
+ *  @return false if events per second or allocations per event are worse than the baseline, beyond the tolerance, or if no baseline
+ */
+bool CheckBaseline(const Parameters &parameters, const Results &results);
+
+/**
+ *  @brief  Split a line of a csv file into its fields
+ *
+ *  @param  line the line
+ *  @param  fields to receive the fields
+ */
+void SplitCsvLine(const std::string &line, std::vector<std::string> &fields);
+
+/**
+ *  @brief  Get the peak resident set size of the process
+ *
+ *  @return the peak resident set size, in kilobytes
+ */
+long GetPeakRSS();
+
+/**
+ *  @brief  Parse the command line arguments, setting the application parameters
+ *
+ *  @param  argc argument count
+ *  @param  argv argument vector
+ *  @param  parameters to receive the application parameters
+ *
+ *  @return success
+ */
+bool ParseCommandLine(int argc, char *argv[], Parameters &parameters);
+
+/**
+ *  @brief  Print the list of configurable options
+ *
+ *  @return false, to force abort
+ */
+bool PrintOptions();
+
+} // namespace pandora_benchmark
+
+#endif // #ifndef PANDORA_BENCHMARK_H
@@ -0,0 +1,744 @@
+/**
+ *  @file   PandoraBenchmarks/src/PandoraBenchmark.cc
+ *
+ *  @brief  Implementation of PandoraBenchmark, measuring the throughput and resource usage of pandora reconstruction chains.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+
+
+#ifdef LAR_CONTENT
+#include "larpandoracontent/LArContent.h"
+#endif
+
+#ifdef LC_CONTENT
+#include "LCContent.h"
+#endif
+
+#include "PandoraBenchmark.h"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <getopt.h>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+
+thread_local unsigned long g_nAllocations(0);       ///< The number of heap allocations made by the current thread
+thread_local unsigned long g_allocatedBytes(0);     ///< The number of bytes allocated on the heap by the current thread
+
+// Synthetic lar geometry: single tpc with typical wire pitches and angles
+const float g_tpcWidthX(250.f);
+const float g_tpcWidthY(230.f);
+const float g_tpcWidthZ(1000.f);
+const float g_wirePitch(0.3f);
+const float g_wireAngleU(0.623599f);
+const float g_wireAngleV(-0.623599f);
+const float g_pi(3.14159265f);
+
+/**
+ *  @brief  Allocate heap memory for the replacement operator new, counting the allocation for the current thread
+ *
+ *  @param  size the number of bytes to allocate
+ *  @param  alignment the required alignment, or zero for the default alignment
+ *
+ *  @return address of the allocated memory
+ */
+void *CountedAllocate(const std::size_t size, const std::size_t alignment)
+{
+    ++g_nAllocations;
+    g_allocatedBytes += size;
+
+    void *pMemory(nullptr);
+
+    if (0 == alignment)
+    {
+        pMemory = std::malloc(size ? size : 1);
+    }
+    else if (0 != posix_memalign(&pMemory, std::max(alignment, sizeof(void *)), size ? size : 1))
+    {
+        pMemory = nullptr;
+    }
+
+    if (!pMemory)
+        throw std::bad_alloc();
+
+    return pMemory;
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+// Replace all forms of the global operator new and delete, so that allocations via the array, sized and aligned forms are also counted
+void *operator new(std::size_t size)
+{
+    return CountedAllocate(size, 0);
+}
+
+void *operator new[](std::size_t size)
+{
+    return CountedAllocate(size, 0);
+}
+
+void operator delete(void *pMemory) noexcept
+{
+    std::free(pMemory);
+}
+
+void operator delete[](void *pMemory) noexcept
+{
+    std::free(pMemory);
+}
+
+void operator delete(void *pMemory, std::size_t) noexcept
+{
+    std::free(pMemory);
+}
+
+void operator delete[](void *pMemory, std::size_t) noexcept
+{
+    std::free(pMemory);
+}
+
+#ifdef __cpp_aligned_new
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    return CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *pMemory, std::align_val_t) noexcept
+{
+    std::free(pMemory);
+}
+
+void operator delete[](void *pMemory, std::align_val_t) noexcept
+{
+    std::free(pMemory);
+}
+
+void operator delete(void *pMemory, std::size_t, std::align_val_t) noexcept
+{
+    std::free(pMemory);
+}
+
+void operator delete[](void *pMemory, std::size_t, std::align_val_t) noexcept
+{
+    std::free(pMemory);
+}
+#endif
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    using namespace pandora_benchmark;
+
+    try
+    {
+        Parameters parameters;
+
+        if (!ParseCommandLine(argc, argv, parameters))
+            return 1;
+
+        PandoraInstanceList pandoraInstances;
+
+        for (int iWorker = 0; iWorker < parameters.m_nWorkers; ++iWorker)
+            pandoraInstances.push_back(CreatePandoraInstance(parameters));
+
+        Results results;
+        RunWorkers(pandoraInstances, parameters, results);
+        WriteResults(parameters, results);
+
+        for (const pandora::Pandora *const pPandora : pandoraInstances)
+            delete pPandora;
+
+        if (results.m_nEvents <= 0)
+            return 1;
+
+        if (!parameters.m_baselineFile.empty() && !CheckBaseline(parameters, results))
+            return 1;
+    }
+    catch (const pandora::StatusCodeException &statusCodeException)
+    {
+        std::cerr << "PandoraBenchmark: Pandora Exception caught: " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "PandoraBenchmark: Unknown exception caught." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace pandora_benchmark
+{
+
+Parameters::Parameters() :
+    m_detector("LAr"),
+    m_tolerance(0.05f),
+    m_nEvents(100),
+    m_nWarmUpEvents(5),
+    m_nSyntheticHits(0),
+    m_nWorkers(1),
+    m_seed(12345)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+Results::Results() :
+    m_nEvents(0),
+    m_inputTime(0.),
+    m_processTime(0.),
+    m_resetTime(0.),
+    m_nAllocations(0),
+    m_allocatedBytes(0),
+    m_peakRSS(0),
+    m_eventsPerSecond(0.)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventQueue::EventQueue(const int nEvents) :
+    m_nEvents(nEvents),
+    m_nextEvent(0),
+    m_isStopped(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool EventQueue::GetNextEvent(int &eventNumber)
+{
+    if (m_isStopped)
+        return false;
+
+    eventNumber = m_nextEvent++;
+
+    return (eventNumber < m_nEvents);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventQueue::Stop()
+{
+    m_isStopped = true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const pandora::Pandora *CreatePandoraInstance(const Parameters &parameters)
+{
+    const pandora::Pandora *const pPandora = new pandora::Pandora();
+    RegisterContent(*pPandora, parameters);
+
+    if (parameters.m_nSyntheticHits > 0)
+        CreateSyntheticLArGeometry(*pPandora);
+
+    PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(*pPandora, parameters.m_settingsFile));
+
+    return pPandora;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RegisterContent(const pandora::Pandora &pandora, const Parameters &parameters)
+{
+#ifdef LAR_CONTENT
+    if ("LAr" == parameters.m_detector)
+    {
+        PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, LArContent::RegisterAlgorithms(pandora));
+        PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, LArContent::RegisterBasicPlugins(pandora));
+        return;
+    }
+#endif
+
+#ifdef LC_CONTENT
+    if ("LC" == parameters.m_detector)
+    {
+        PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, LCContent::RegisterAlgorithms(pandora));
+        PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, LCContent::RegisterBasicPlugins(pandora));
+
+        // Default ild field map, as used by the standard lc settings
+        PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, LCContent::RegisterBFieldPlugin(pandora, 3.5f, -1.5f, 0.01f));
+        return;
+    }
+#endif
+
+    std::cerr << "PandoraBenchmark: content for detector " << parameters.m_detector << " is unavailable" << std::endl;
+    throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CreateSyntheticLArGeometry(const pandora::Pandora &pandora)
+{
+    PandoraApi::Geometry::LArTPC::Parameters parameters;
+    parameters.m_larTPCVolumeId = 0;
+    parameters.m_centerX = 0.5f * g_tpcWidthX;
+    parameters.m_centerY = 0.f;
+    parameters.m_centerZ = 0.5f * g_tpcWidthZ;
+    parameters.m_widthX = g_tpcWidthX;
+    parameters.m_widthY = g_tpcWidthY;
+    parameters.m_widthZ = g_tpcWidthZ;
+    parameters.m_wirePitchU = g_wirePitch;
+    parameters.m_wirePitchV = g_wirePitch;
+    parameters.m_wirePitchW = g_wirePitch;
+    parameters.m_wireAngleU = g_wireAngleU;
+    parameters.m_wireAngleV = g_wireAngleV;
+    parameters.m_wireAngleW = 0.f;
+    parameters.m_sigmaUVW = 1.f;
+    parameters.m_isDriftInPositiveX = true;
+    PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::LArTPC::Create(pandora, parameters));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CreateSyntheticLArEvent(const pandora::Pandora &pandora, const Parameters &parameters, std::mt19937 &generator, int &hitCounter)
+{
+    std::uniform_real_distribution<float> uniform(0.f, 1.f);
+    std::normal_distribution<float> normal(0.f, 1.f);
+
+    PandoraApi::CaloHit::Parameters caloHitParameters;
+    caloHitParameters.m_expectedDirection = pandora::CartesianVector(0.f, 0.f, 1.f);
+    caloHitParameters.m_cellNormalVector = pandora::CartesianVector(0.f, 0.f, 1.f);
+    caloHitParameters.m_cellGeometry = pandora::RECTANGULAR;
+    caloHitParameters.m_cellSize0 = 0.5f;
+    caloHitParameters.m_cellSize1 = g_wirePitch;
+    caloHitParameters.m_cellThickness = g_wirePitch;
+    caloHitParameters.m_nCellRadiationLengths = 1.f;
+    caloHitParameters.m_nCellInteractionLengths = 1.f;
+    caloHitParameters.m_time = 0.f;
+    caloHitParameters.m_isDigital = false;
+    caloHitParameters.m_hitRegion = pandora::SINGLE_REGION;
+    caloHitParameters.m_layer = 0;
+    caloHitParameters.m_isInOuterSamplingLayer = false;
+
+    const pandora::HitType hitTypes[3] = {pandora::TPC_VIEW_U, pandora::TPC_VIEW_V, pandora::TPC_VIEW_W};
+    const float wireAngles[3] = {g_wireAngleU, g_wireAngleV, 0.f};
+
+    int nParticles(0), nHitsPerView(0);
+
+    while (nHitsPerView < parameters.m_nSyntheticHits)
+    {
+        // Every third particle is shower-like, the others track-like, each sampled at the wire pitch along a straight 3D trajectory
+        const bool isShower(0 == (++nParticles % 3));
+        const float transverseSpread(isShower ? 2.f : 0.f);
+        const float length(10.f + (isShower ? 40.f : 190.f) * uniform(generator));
+        const float cosTheta(2.f * uniform(generator) - 1.f), phi(2.f * g_pi * uniform(generator));
+        const float sinTheta(std::sqrt(1.f - cosTheta * cosTheta));
+        const pandora::CartesianVector direction(sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta);
+        const pandora::CartesianVector start(g_tpcWidthX * uniform(generator), g_tpcWidthY * (uniform(generator) - 0.5f), g_tpcWidthZ * uniform(generator));
+
+        for (float distance = 0.f; (distance < length) && (nHitsPerView < parameters.m_nSyntheticHits); distance += g_wirePitch)
+        {
+            const pandora::CartesianVector position(start + direction * distance +
+                pandora::CartesianVector(normal(generator), normal(generator), normal(generator)) * transverseSpread);
+
+            if ((position.GetX() < 0.f) || (position.GetX() > g_tpcWidthX) || (std::fabs(position.GetY()) > 0.5f * g_tpcWidthY) ||
+                (position.GetZ() < 0.f) || (position.GetZ() > g_tpcWidthZ))
+            {
+                break;
+            }
+
+            const float energy(isShower ? 0.002f * (1.f + uniform(generator)) : 0.0021f);
+            caloHitParameters.m_inputEnergy = energy;
+            caloHitParameters.m_mipEquivalentEnergy = energy / 0.0021f;
+            caloHitParameters.m_electromagneticEnergy = energy;
+            caloHitParameters.m_hadronicEnergy = energy;
+
+            for (unsigned int iView = 0; iView < 3; ++iView)
+            {
+                const float wireCoordinate(position.GetZ() * std::cos(wireAngles[iView]) - position.GetY() * std::sin(wireAngles[iView]));
+                caloHitParameters.m_positionVector = pandora::CartesianVector(position.GetX(), 0.f, wireCoordinate);
+                caloHitParameters.m_hitType = hitTypes[iView];
+                caloHitParameters.m_pParentAddress = reinterpret_cast<void *>(static_cast<intptr_t>(++hitCounter));
+                PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(pandora, caloHitParameters));
+            }
+
+            ++nHitsPerView;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RunWorkers(const PandoraInstanceList &pandoraInstances, const Parameters &parameters, Results &results)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    // Warm-up events are numbered after the measured events, so that the measured events do not depend on the number of workers
+    const unsigned int nWorkers(pandoraInstances.size());
+    std::vector<Results> workerResults(nWorkers);
+
+    RunInWorkerThreads(nWorkers, [&pandoraInstances, &parameters](const unsigned int iWorker)
+    {
+        Results warmUpResults;
+
+        for (int iEvent = 0; iEvent < parameters.m_nWarmUpEvents; ++iEvent)
+        {
+            const int eventNumber(parameters.m_nEvents + static_cast<int>(iWorker) * parameters.m_nWarmUpEvents + iEvent);
+
+            if (!ProcessEvent(*pandoraInstances.at(iWorker), parameters, eventNumber, warmUpResults))
+                break;
+        }
+    });
+
+    // Measured events are taken from a shared queue by whichever worker is free
+    EventQueue eventQueue(parameters.m_nEvents);
+    const Clock::time_point start(Clock::now());
+
+    RunInWorkerThreads(nWorkers, [&pandoraInstances, &parameters, &workerResults, &eventQueue](const unsigned int iWorker)
+    {
+        int eventNumber(0);
+
+        while (eventQueue.GetNextEvent(eventNumber))
+        {
+            if (!ProcessEvent(*pandoraInstances.at(iWorker), parameters, eventNumber, workerResults.at(iWorker)))
+            {
+                eventQueue.Stop();
+                break;
+            }
+        }
+    });
+
+    const double wallTime(std::chrono::duration<double>(Clock::now() - start).count());
+
+    for (const Results &workerResult : workerResults)
+    {
+        results.m_nEvents += workerResult.m_nEvents;
+        results.m_inputTime += workerResult.m_inputTime;
+        results.m_processTime += workerResult.m_processTime;
+        results.m_resetTime += workerResult.m_resetTime;
+        results.m_nAllocations += workerResult.m_nAllocations;
+        results.m_allocatedBytes += workerResult.m_allocatedBytes;
+    }
+
+    results.m_eventsPerSecond = (wallTime > 0.) ? results.m_nEvents / wallTime : 0.;
+    results.m_peakRSS = GetPeakRSS();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RunInWorkerThreads(const unsigned int nWorkers, const std::function<void(const unsigned int)> &work)
+{
+    std::vector<std::exception_ptr> workerExceptions(nWorkers);
+    std::vector<std::thread> workers;
+
+    for (unsigned int iWorker = 0; iWorker < nWorkers; ++iWorker)
+    {
+        workers.push_back(std::thread([&work, &workerExceptions, iWorker]()
+        {
+            try
+            {
+                work(iWorker);
+            }
+            catch (...)
+            {
+                workerExceptions.at(iWorker) = std::current_exception();
+            }
+        }));
+    }
+
+    for (std::thread &worker : workers)
+        worker.join();
+
+    for (const std::exception_ptr &pException : workerExceptions)
+    {
+        if (pException)
+            std::rethrow_exception(pException);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ProcessEvent(const pandora::Pandora &pandora, const Parameters &parameters, const int eventNumber, Results &results)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    const unsigned long nAllocations(g_nAllocations), allocatedBytes(g_allocatedBytes);
+    const Clock::time_point inputStart(Clock::now());
+
+    if (parameters.m_nSyntheticHits > 0)
+    {
+        std::mt19937 generator(parameters.m_seed + eventNumber);
+        int hitCounter(0);
+        CreateSyntheticLArEvent(pandora, parameters, generator, hitCounter);
+    }
+
+    const Clock::time_point processStart(Clock::now());
+
+    try
+    {
+        PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(pandora));
+    }
+    catch (const pandora::StatusCodeException &statusCodeException)
+    {
+        // Events read via the settings end when the event reading algorithm finds no further event in its input files
+        if ((parameters.m_nSyntheticHits > 0) || (pandora::STATUS_CODE_NOT_FOUND != statusCodeException.GetStatusCode()))
+            throw;
+
+        std::cout << "PandoraBenchmark: input files exhausted, " << statusCodeException.ToString() << std::endl;
+        PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(pandora));
+        return false;
+    }
+
+    const Clock::time_point resetStart(Clock::now());
+    PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(pandora));
+    const Clock::time_point resetEnd(Clock::now());
+
+    ++results.m_nEvents;
+    results.m_inputTime += std::chrono::duration<double>(processStart - inputStart).count();
+    results.m_processTime += std::chrono::duration<double>(resetStart - processStart).count();
+    results.m_resetTime += std::chrono::duration<double>(resetEnd - resetStart).count();
+    results.m_nAllocations += g_nAllocations - nAllocations;
+    results.m_allocatedBytes += g_allocatedBytes - allocatedBytes;
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void WriteResults(const Parameters &parameters, const Results &results)
+{
+    if (results.m_nEvents <= 0)
+    {
+        std::cout << "PandoraBenchmark: no events measured" << std::endl;
+        return;
+    }
+
+    const double nEvents(static_cast<double>(results.m_nEvents));
+
+    std::cout << std::fixed << std::setprecision(3)
+              << "PandoraBenchmark: " << parameters.m_settingsFile << ", " << results.m_nEvents << " events, " << parameters.m_nWorkers << " workers" << std::endl
+              << "  Events per second      : " << results.m_eventsPerSecond << std::endl
+              << "  Input time [ms/event]  : " << 1000. * results.m_inputTime / nEvents << std::endl
+              << "  Process time [ms/event]: " << 1000. * results.m_processTime / nEvents << std::endl
+              << "  Reset time [ms/event]  : " << 1000. * results.m_resetTime / nEvents << std::endl
+              << "  Allocations per event  : " << results.m_nAllocations / nEvents << std::endl
+              << "  Allocated kB per event : " << results.m_allocatedBytes / (1024. * nEvents) << std::endl
+              << "  Peak RSS [MB]          : " << results.m_peakRSS / 1024. << std::endl;
+
+    if (parameters.m_csvFile.empty())
+        return;
+
+    const bool writeHeader(!std::ifstream(parameters.m_csvFile.c_str()).good());
+    std::ofstream csvFile(parameters.m_csvFile.c_str(), std::ios::app);
+
+    if (writeHeader)
+    {
+        csvFile << "settings,detector,syntheticHits,seed,workers,events,eventsPerSecond,inputMsPerEvent,processMsPerEvent,resetMsPerEvent,"
+                << "allocationsPerEvent,allocatedBytesPerEvent,peakRSSkB" << std::endl;
+    }
+
+    csvFile << parameters.m_settingsFile << "," << parameters.m_detector << "," << parameters.m_nSyntheticHits << "," << parameters.m_seed << ","
+            << parameters.m_nWorkers << "," << results.m_nEvents << "," << results.m_eventsPerSecond << "," << 1000. * results.m_inputTime / nEvents << ","
+            << 1000. * results.m_processTime / nEvents << "," << 1000. * results.m_resetTime / nEvents << ","
+            << results.m_nAllocations / nEvents << "," << results.m_allocatedBytes / nEvents << "," << results.m_peakRSS << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool CheckBaseline(const Parameters &parameters, const Results &results)
+{
+    std::ifstream baselineFile(parameters.m_baselineFile.c_str());
+    std::string line;
+    std::vector<std::string> columns, fields, baselineFields;
+
+    if (!std::getline(baselineFile, line))
+    {
+        std::cout << "PandoraBenchmark: cannot read baseline file " << parameters.m_baselineFile << std::endl;
+        return false;
+    }
+
+    SplitCsvLine(line, columns);
+
+    const auto GetField = [&columns](const std::vector<std::string> &lineFields, const std::string &column) -> std::string
+    {
+        const auto iter(std::find(columns.begin(), columns.end(), column));
+        const std::size_t index(iter - columns.begin());
+        return (index < lineFields.size()) ? lineFields.at(index) : std::string();
+    };
+
+    // Results are compared for the same settings file name, so that baselines can be recorded from another installation
+    const auto GetFileName = [](const std::string &path) -> std::string
+    {
+        return path.substr(path.find_last_of('/') + 1);
+    };
+
+    while (std::getline(baselineFile, line))
+    {
+        SplitCsvLine(line, fields);
+
+        if ((GetFileName(GetField(fields, "settings")) == GetFileName(parameters.m_settingsFile)) &&
+            (GetField(fields, "detector") == parameters.m_detector) && (std::atoi(GetField(fields, "syntheticHits").c_str()) == parameters.m_nSyntheticHits) &&
+            (std::atoi(GetField(fields, "workers").c_str()) == parameters.m_nWorkers))
+        {
+            baselineFields = fields;
+        }
+    }
+
+    if (baselineFields.empty())
+    {
+        std::cout << "PandoraBenchmark: no baseline entry for " << parameters.m_settingsFile << " in " << parameters.m_baselineFile << std::endl;
+        return false;
+    }
+
+    const double baselineEventsPerSecond(std::atof(GetField(baselineFields, "eventsPerSecond").c_str()));
+    const double baselineAllocationsPerEvent(std::atof(GetField(baselineFields, "allocationsPerEvent").c_str()));
+    const double allocationsPerEvent(results.m_nAllocations / static_cast<double>(results.m_nEvents));
+
+    const bool isThroughputRegression(results.m_eventsPerSecond < (1. - parameters.m_tolerance) * baselineEventsPerSecond);
+    const bool isAllocationRegression(allocationsPerEvent > (1. + parameters.m_tolerance) * baselineAllocationsPerEvent);
+
+    std::cout << "PandoraBenchmark: check against baseline " << parameters.m_baselineFile << ", tolerance " << parameters.m_tolerance << std::endl
+              << "  Events per second      : " << results.m_eventsPerSecond << ", baseline " << baselineEventsPerSecond
+              << (isThroughputRegression ? " REGRESSION" : " ok") << std::endl
+              << "  Allocations per event  : " << allocationsPerEvent << ", baseline " << baselineAllocationsPerEvent
+              << (isAllocationRegression ? " REGRESSION" : " ok") << std::endl;
+
+    return (!isThroughputRegression && !isAllocationRegression);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SplitCsvLine(const std::string &line, std::vector<std::string> &fields)
+{
+    fields.clear();
+    std::stringstream stream(line);
+    std::string field;
+
+    while (std::getline(stream, field, ','))
+        fields.push_back(field);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+long GetPeakRSS()
+{
+    struct rusage usage;
+
+    if (0 != getrusage(RUSAGE_SELF, &usage))
+        return 0;
+
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ParseCommandLine(int argc, char *argv[], Parameters &parameters)
+{
+    if (1 == argc)
+        return PrintOptions();
+
+    int c(0);
+
+    while ((c = getopt(argc, argv, "i:d:n:w:s:r:t:o:c:x:h")) != -1)
+    {
+        switch (c)
+        {
+        case 'i':
+            parameters.m_settingsFile = optarg;
+            break;
+        case 'd':
+            parameters.m_detector = optarg;
+            break;
+        case 'n':
+            parameters.m_nEvents = atoi(optarg);
+            break;
+        case 'w':
+            parameters.m_nWarmUpEvents = atoi(optarg);
+            break;
+        case 's':
+            parameters.m_nSyntheticHits = atoi(optarg);
+            break;
+        case 'r':
+            parameters.m_seed = static_cast<unsigned int>(atoi(optarg));
+            break;
+        case 't':
+            parameters.m_nWorkers = atoi(optarg);
+            break;
+        case 'o':
+            parameters.m_csvFile = optarg;
+            break;
+        case 'c':
+            parameters.m_baselineFile = optarg;
+            break;
+        case 'x':
+            parameters.m_tolerance = static_cast<float>(atof(optarg));
+            break;
+        case 'h':
+        default:
+            return PrintOptions();
+        }
+    }
+
+    if (parameters.m_settingsFile.empty() || (parameters.m_nEvents <= 0) || (parameters.m_nWarmUpEvents < 0) ||
+        (parameters.m_nWorkers <= 0) || (parameters.m_tolerance < 0.f))
+        return PrintOptions();
+
+    if ((parameters.m_nSyntheticHits > 0) && ("LAr" != parameters.m_detector))
+    {
+        std::cout << "PandoraBenchmark: synthetic events are only available for the LAr detector" << std::endl;
+        return false;
+    }
+
+    if ((parameters.m_nWorkers > 1) && (parameters.m_nSyntheticHits <= 0))
+    {
+        std::cout << "PandoraBenchmark: concurrent workers require synthetic events, as each instance reads its own input files" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool PrintOptions()
+{
+    std::cout << std::endl << "./bin/PandoraBenchmark " << std::endl
+              << "    -i Settings.xml         (required) [algorithm description: xml]" << std::endl
+              << "    -d LAr                  (optional) [detector type, LAr or LC, selecting the content library]" << std::endl
+              << "    -n NEventsToProcess     (optional) [no. of measured events, default 100]" << std::endl
+              << "    -w NWarmUpEvents        (optional) [no. of events processed before measurement, default 5]" << std::endl
+              << "    -s NSyntheticHits       (optional) [no. of synthetic LAr hits per view and event, else events read via settings]" << std::endl
+              << "    -r Seed                 (optional) [seed for synthetic events, default 12345]" << std::endl
+              << "    -t NWorkers             (optional) [no. of pandora instances processing events concurrently, default 1]" << std::endl
+              << "    -o Results.csv          (optional) [csv file to which results are appended]" << std::endl
+              << "    -c Baseline.csv         (optional) [csv file of baseline results, exit with failure on regression against the last matching entry]" << std::endl
+              << "    -x Tolerance            (optional) [fractional tolerance on events per second and allocations per event, default 0.05]" << std::endl << std::endl;
+
+    return false;
+}
+
+} // namespace pandora_benchmark